@@ -0,0 +1,115 @@
+/** @file
+ *
+ * Bluetooth stack buffer pool usage telemetry
+ *
+ */
+#include "wiced.h"
+#include <string.h>
+#include "wiced_bt_dev.h"
+#include "wiced_bt_cfg.h"
+#include "bt_pool_stats.h"
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+static bt_pool_stats_t  pool_stats[WICED_BT_CFG_NUM_BUF_POOLS];
+static uint16_t         window_peak[WICED_BT_CFG_NUM_BUF_POOLS];   /* Most buffers in use seen by bt_pool_stats_track() this window */
+static uint16_t         stack_peak[WICED_BT_CFG_NUM_BUF_POOLS];    /* Stack's max_allocated_count at the end of the previous window */
+static uint32_t         sample_count;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+void bt_pool_stats_track( void )
+{
+    wiced_bt_buffer_statistics_t usage[WICED_BT_CFG_NUM_BUF_POOLS];
+    int i;
+
+    memset( usage, 0, sizeof( usage ) );
+    if ( wiced_bt_get_buffer_usage( usage, sizeof( usage ) ) != WICED_BT_SUCCESS )
+    {
+        return;
+    }
+
+    for ( i = 0; i < WICED_BT_CFG_NUM_BUF_POOLS; i++ )
+    {
+        if ( usage[i].current_allocated_count > window_peak[i] )
+        {
+            window_peak[i] = usage[i].current_allocated_count;
+        }
+    }
+}
+
+wiced_result_t bt_pool_stats_sample( void )
+{
+    wiced_bt_buffer_statistics_t usage[WICED_BT_CFG_NUM_BUF_POOLS];
+    wiced_result_t result;
+    int i;
+
+    memset( usage, 0, sizeof( usage ) );
+    result = wiced_bt_get_buffer_usage( usage, sizeof( usage ) );
+    if ( result != WICED_BT_SUCCESS )
+    {
+        WPRINT_APP_INFO( ( "[BT/Pool] Reading buffer usage failed(returned: %d)\n", result ) );
+        return result;
+    }
+
+    for ( i = 0; i < WICED_BT_CFG_NUM_BUF_POOLS; i++ )
+    {
+        bt_pool_stats_t* stats = &pool_stats[i];
+        uint16_t peak = window_peak[i];
+
+        stats->buf_size  = usage[i].pool_size;
+        stats->buf_count = usage[i].total_count;
+        stats->in_use    = usage[i].current_allocated_count;
+
+        if ( stats->in_use > peak )
+        {
+            peak = stats->in_use;
+        }
+        if ( peak > stats->high_water )
+        {
+            stats->high_water = peak;
+        }
+        if ( usage[i].max_allocated_count > stats->high_water )
+        {
+            stats->high_water = usage[i].max_allocated_count;
+        }
+
+        // Advertising report buffers are freed long before the window ends, so look at the peaks instead of in_use:
+        // the pool ran dry if a report saw it full, or if the stack's own peak first reached the pool size this window
+        if ( ( stats->buf_count != 0 ) &&
+             ( ( peak >= stats->buf_count ) ||
+               ( ( usage[i].max_allocated_count > stack_peak[i] ) && ( usage[i].max_allocated_count >= stats->buf_count ) ) ) )
+        {
+            stats->exhausted++;
+        }
+
+        stack_peak[i]  = usage[i].max_allocated_count;
+        window_peak[i] = 0;
+    }
+
+    sample_count++;
+    if ( ( sample_count % BT_POOL_STATS_REPORT_INTERVAL ) == 0 )
+    {
+        bt_pool_stats_report( );
+    }
+
+    return WICED_BT_SUCCESS;
+}
+
+void bt_pool_stats_report( void )
+{
+    int i;
+
+    for ( i = 0; i < WICED_BT_CFG_NUM_BUF_POOLS; i++ )
+    {
+        const bt_pool_stats_t* stats = &pool_stats[i];
+
+        WPRINT_APP_INFO( ( "[BT/Pool] sample=%lu pool=%d size=%u count=%u in_use=%u high_water=%u exhausted=%lu\n",
+                           (unsigned long) sample_count, i, stats->buf_size, stats->buf_count,
+                           stats->in_use, stats->high_water, (unsigned long) stats->exhausted ) );
+    }
+}
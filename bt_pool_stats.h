@@ -0,0 +1,58 @@
+/** @file
+ *
+ * Bluetooth stack buffer pool usage telemetry
+ *
+ * Tracks the stack's per-pool allocation counters on every advertising report,
+ * folds them into per-window counters at the end of each scan window and
+ * periodically prints them to the console. The printed lines are consumed by
+ * tools/bt_pool_sizing.py to derive a right-sized wiced_bt_cfg_buf_pools table.
+ *
+ */
+#pragma once
+
+#include "wiced.h"
+#include "wiced_bt_cfg.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* Number of samples between two console reports (one sample per scan window) */
+#ifndef BT_POOL_STATS_REPORT_INTERVAL
+#define BT_POOL_STATS_REPORT_INTERVAL       (12)
+#endif
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+typedef struct
+{
+    uint16_t buf_size;          /* Size of each buffer in the pool */
+    uint16_t buf_count;         /* Number of buffers in the pool */
+    uint16_t in_use;            /* Buffers allocated at the end of the last scan window */
+    uint16_t high_water;        /* Most buffers ever allocated at the same time */
+    uint32_t exhausted;         /* Scan windows in which every buffer of the pool was allocated at some point */
+} bt_pool_stats_t;
+
+/******************************************************
+ *               Function Declarations
+ ******************************************************/
+
+/* Record the current buffer usage into this window's peak. Called for every advertising report */
+void bt_pool_stats_track( void );
+
+/* Close the scan window: read the stack's buffer usage and update the counters. Prints a report every BT_POOL_STATS_REPORT_INTERVAL calls */
+wiced_result_t bt_pool_stats_sample( void );
+
+/* Print the current counters, one line per pool */
+void bt_pool_stats_report( void );
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
@@ -31,6 +31,8 @@ and pushes data to the cloud. Thus, we will be able to follow the crowd density
 #include "wiced_bt_dev.h"
 #include "wiced_low_power.h"
 #include "wiced_bt_uuid.h"
+#include "bt_pool_stats.h"
+#include "psoc_gw_profile.h"
 
 
 /******************************************************
@@ -41,10 +43,10 @@ and pushes data to the cloud. Thus, we will be able to follow the crowd density
 #define APP_AWS_CONNACK_TIMEOUT             (3 * APPLICATION_DELAY_IN_MILLISECONDS)
 #define APP_AWS_PUBLISH_ACK_TIMEOUT         (2 * APPLICATION_DELAY_IN_MILLISECONDS)
 #define SCANNER_AWS_INITIALIZE_TIMEOUT       (30 * APPLICATION_DELAY_IN_MILLISECONDS)
-#define SCANNER_PUBLISH_TIMEOUT              (5 *  APPLICATION_DELAY_IN_MILLISECONDS)
+#define SCANNER_PUBLISH_TIMEOUT              ((PSOC_GW_SCAN_DURATION_SECONDS + 1) * APPLICATION_DELAY_IN_MILLISECONDS) // One second margin over the stack's scan duration
 #define PUBLISHER_CERTIFICATES_MAX_SIZE            (0x7fffffff)
 #define WICED_TOPIC                                "PSOC_GW"
-#define APP_PUBLISH_RETRY_COUNT                    (5)
+#define APP_PUBLISH_RETRY_COUNT                    PSOC_GW_PUBLISH_RETRY_COUNT
 
 /******************************************************
  *               Variable Definitions
@@ -55,9 +57,10 @@ static wiced_semaphore_t  event_semaphore;
 extern const wiced_bt_cfg_settings_t wiced_bt_cfg_settings;
 extern const wiced_bt_cfg_buf_pool_t wiced_bt_cfg_buf_pools[];
 static wiced_bool_t             is_connected = WICED_FALSE;
-static wiced_aws_qos_level_t    qos = WICED_AWS_QOS_ATMOST_ONCE;
+static wiced_aws_qos_level_t    qos = PSOC_GW_PUBLISH_QOS;
 int scan_result; //Number of devices
-char msg[33]; //Message to publish
+int scan_windows; //Scan windows counted into scan_result
+char msg[64]; //Message to publish
 
 static wiced_aws_thing_security_info_t my_publisher_security_creds =
 {
@@ -268,6 +271,7 @@ static void my_publisher_aws_callback( wiced_aws_handle_t aws, wiced_aws_event_t
 // Every Ble scan event activates callback function
 void ble_scanner_scan_result_cback( wiced_bt_ble_scan_results_t* p_scan_result, uint8_t* p_adv_data ) {
     if ( p_scan_result != NULL ) scan_result++; // Every result one point
+    bt_pool_stats_track(); // Report buffers are short-lived, catch the pool peaks while they are held
 
 }
 
@@ -281,6 +285,7 @@ void application_start( void )
 
     wiced_core_init();
     wiced_init( );
+    psoc_gw_profile_print( );
     wiced_bt_stack_init( ble_scanner_management_callback , &wiced_bt_cfg_settings, wiced_bt_cfg_buf_pools ); // init ble stack
 
 
@@ -359,8 +364,17 @@ void application_start( void )
                 continue;
             }
 
-            sprintf(msg, "GW_ID:AWS01, Active_Scanned=%d",  scan_result);
+            bt_pool_stats_sample(); // Record how many stack buffers the scan window needed
+
+            if (++scan_windows < PSOC_GW_WINDOWS_PER_PUBLISH) // Keep counting until the profile's publish period is over
+            {
+                continue;
+            }
+
+            // A device that stays for the whole period is counted once per window, so report how many windows were summed
+            snprintf(msg, sizeof(msg), "GW_ID:AWS01, Active_Scanned=%d, Windows=%d",  scan_result, scan_windows);
             scan_result=0;
+            scan_windows=0;
 
             WPRINT_APP_INFO(("[Application/AWS] Publishing... %s\n", msg)); // Publish the results to the cloud service
             pub_retries = 0;
@@ -2,7 +2,9 @@
 NAME := apps_demo_psoc_gw
 
 $(NAME)_SOURCES := psoc_gw.c \
-                      wiced_bt_cfg.c
+                      wiced_bt_cfg.c \
+                      bt_pool_stats.c \
+                      psoc_gw_profile.c
                       
 $(NAME)_RESOURCES  += apps/aws/iot/rootca.cer \
                       apps/aws/iot/publisher/client.cer \
@@ -15,6 +17,18 @@ $(NAME)_COMPONENTS += libraries/drivers/bluetooth/low_energy
 
 WIFI_CONFIG_DCT_H := wifi_config_dct.h
 
+# Deployment profile (see psoc_gw_profile.h), select on the build line:
+#   ./make apps.demo.psoc_gw-<PLATFORM> PSOC_GW_PROFILE=DENSE_CORRIDOR
+PSOC_GW_PROFILE ?= DEFAULT
+VALID_PSOC_GW_PROFILES := DEFAULT \
+                          DENSE_CORRIDOR \
+                          LOW_POWER_BATTERY \
+                          BACKHAUL_CONSTRAINED
+ifeq ($(filter $(PSOC_GW_PROFILE),$(VALID_PSOC_GW_PROFILES)),)
+$(error Unknown PSOC_GW_PROFILE '$(PSOC_GW_PROFILE)', valid profiles are: $(VALID_PSOC_GW_PROFILES))
+endif
+GLOBAL_DEFINES += PSOC_GW_PROFILE=PSOC_GW_$(PSOC_GW_PROFILE)
+
                  
 
 
@@ -34,10 +48,16 @@ VALID_PLATFORMS := CY8CKIT_062 \
                    psoc_gw*
 
 ifeq ($(PLATFORM),$(filter $(PLATFORM), CYW9MCU7X9N364))
-GLOBAL_DEFINES += PLATFORM_HEAP_SIZE=40*1024
+PSOC_GW_PLATFORM_HEAP_SIZE ?= 40*1024
 USE_LIBC_PRINTF     := 0
 endif
 
+# The profiles' BT buffer pool budget is a share of this heap (see psoc_gw_profile.h)
+ifneq ($(PSOC_GW_PLATFORM_HEAP_SIZE),)
+GLOBAL_DEFINES += PLATFORM_HEAP_SIZE=$(PSOC_GW_PLATFORM_HEAP_SIZE) \
+                  PSOC_GW_PLATFORM_HEAP_SIZE=$(PSOC_GW_PLATFORM_HEAP_SIZE)
+endif
+
 
 C_FLAGS += -DWICED_BT_TRACE_ENABLE
 #C_FLAGS += -DENABLE_HCI_TRACE
@@ -0,0 +1,88 @@
+/** @file
+ *
+ * Compile-time deployment profiles
+ *
+ */
+#include "wiced.h"
+#include "wiced_aws.h"
+#include "wiced_bt_cfg.h"
+#include "psoc_gw_profile.h"
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/* Consistency checks of one profile; applied to every profile in every build */
+#define PSOC_GW_PROFILE_CHECKS( p )                                                                                     \
+    _Static_assert( p##_HIGH_DUTY_SCAN_WINDOW <= p##_HIGH_DUTY_SCAN_INTERVAL,                                           \
+                    #p ": high duty scan window must not be larger than the scan interval" );                           \
+    _Static_assert( p##_LOW_DUTY_SCAN_WINDOW <= p##_LOW_DUTY_SCAN_INTERVAL,                                             \
+                    #p ": low duty scan window must not be larger than the scan interval" );                            \
+    _Static_assert( ( p##_HIGH_DUTY_SCAN_WINDOW >= 0x0004 ) && ( p##_HIGH_DUTY_SCAN_INTERVAL <= 0x4000 ) &&             \
+                    ( p##_LOW_DUTY_SCAN_WINDOW >= 0x0004 ) && ( p##_LOW_DUTY_SCAN_INTERVAL <= 0x4000 ),                 \
+                    #p ": scan interval and window must be within 0x0004..0x4000 slots" );                              \
+    _Static_assert( p##_SCAN_DURATION_SECONDS > 0,                                                                      \
+                    #p ": an infinite high duty scan never ends the scan window" );                                     \
+    _Static_assert( PSOC_GW_PROFILE_POOL_RAM( p ) <= PSOC_GW_BT_POOL_RAM_BUDGET,                                        \
+                    #p ": buffer pools exceed PSOC_GW_BT_POOL_HEAP_PERCENT of the platform heap" );                     \
+    _Static_assert( ( p##_GATT_MAX_ATTR_LEN <= 512 ) && ( p##_GATT_MAX_ATTR_LEN <= PSOC_GW_BT_POOL_3_SIZE ),            \
+                    #p ": max_attr_len must fit into the largest buffer pool" );                                        \
+    _Static_assert( ( p##_WINDOWS_PER_PUBLISH >= 1 ) && ( p##_PUBLISH_RETRY_COUNT >= 1 ),                               \
+                    #p ": publish policy needs at least one window per publish and one attempt" );
+
+#define PSOC_GW_PROFILE_ENTRY( p )                                              \
+    [p##_ID] =                                                                  \
+    {                                                                           \
+        .name                           = p##_NAME,                             \
+        .high_duty_scan_interval        = p##_HIGH_DUTY_SCAN_INTERVAL,          \
+        .high_duty_scan_window          = p##_HIGH_DUTY_SCAN_WINDOW,            \
+        .low_duty_scan_interval         = p##_LOW_DUTY_SCAN_INTERVAL,           \
+        .low_duty_scan_window           = p##_LOW_DUTY_SCAN_WINDOW,             \
+        .scan_duration_seconds          = p##_SCAN_DURATION_SECONDS,            \
+        .low_duty_scan_duration_seconds = p##_LOW_DUTY_SCAN_DURATION_SECONDS,   \
+        .gatt_client_max_links          = p##_GATT_CLIENT_MAX_LINKS,            \
+        .gatt_server_max_links          = p##_GATT_SERVER_MAX_LINKS,            \
+        .gatt_max_attr_len              = p##_GATT_MAX_ATTR_LEN,                \
+        .addr_resolution_db_size        = p##_ADDR_RESOLUTION_DB_SIZE,          \
+        .bt_pool_count                  = { p##_BT_POOL_0_COUNT,                \
+                                            p##_BT_POOL_1_COUNT,                \
+                                            p##_BT_POOL_2_COUNT,                \
+                                            p##_BT_POOL_3_COUNT },              \
+        .bt_pool_ram                    = PSOC_GW_PROFILE_POOL_RAM( p ),        \
+        .windows_per_publish            = p##_WINDOWS_PER_PUBLISH,              \
+        .publish_qos                    = p##_PUBLISH_QOS,                      \
+        .publish_retry_count            = p##_PUBLISH_RETRY_COUNT,              \
+    },
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+PSOC_GW_PROFILES( PSOC_GW_PROFILE_CHECKS )
+
+static const psoc_gw_profile_t psoc_gw_profiles[] =
+{
+    PSOC_GW_PROFILES( PSOC_GW_PROFILE_ENTRY )
+};
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+const psoc_gw_profile_t* psoc_gw_profile_get( void )
+{
+    return &psoc_gw_profiles[PSOC_GW_CFG( ID )];
+}
+
+void psoc_gw_profile_print( void )
+{
+    const psoc_gw_profile_t* profile = psoc_gw_profile_get( );
+
+    WPRINT_APP_INFO( ( "[Application] Deployment profile: %s\n", profile->name ) );
+    WPRINT_APP_INFO( ( "[Application]   scan %u/%u slots for %u s, %u window(s) per publish, QoS %u, %u attempt(s)\n",
+                       profile->high_duty_scan_window, profile->high_duty_scan_interval, profile->scan_duration_seconds,
+                       profile->windows_per_publish, profile->publish_qos, profile->publish_retry_count ) );
+    WPRINT_APP_INFO( ( "[Application]   BT pools %u/%u/%u/%u buffers, %lu of %lu budget bytes\n",
+                       profile->bt_pool_count[0], profile->bt_pool_count[1], profile->bt_pool_count[2], profile->bt_pool_count[3],
+                       (unsigned long) profile->bt_pool_ram, (unsigned long) PSOC_GW_BT_POOL_RAM_BUDGET ) );
+}
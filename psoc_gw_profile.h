@@ -0,0 +1,239 @@
+/** @file
+ *
+ * Compile-time deployment profiles
+ *
+ * A profile selects the BLE scan timing, the Bluetooth stack buffer pools and
+ * table capacities, the scan window length and the publish policy. Every
+ * profile is described by a set of PSOC_GW_<profile>_<field> macros and listed
+ * in PSOC_GW_PROFILES; psoc_gw_profile.c turns the list into a const table and
+ * checks every entry, whichever profile is built.
+ *
+ * Exactly one profile is active; it is chosen on the build line, e.g.
+ *
+ *   ./make apps.demo.psoc_gw-CY8CKIT_062 PSOC_GW_PROFILE=DENSE_CORRIDOR
+ *
+ * which defines PSOC_GW_PROFILE=PSOC_GW_<name> (see psoc_gw.mk). Without a
+ * selection the DEFAULT profile is used. Scan intervals and windows are in
+ * 0.625 ms slots.
+ *
+ */
+#pragma once
+
+#include "wiced.h"
+#include "wiced_bt_cfg.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+#ifndef PSOC_GW_PROFILE
+#define PSOC_GW_PROFILE                         PSOC_GW_DEFAULT
+#endif
+
+/* Field of the active profile, e.g. PSOC_GW_CFG( SCAN_DURATION_SECONDS ) */
+#define PSOC_GW_CFG( field )                    PSOC_GW_CFG_PASTE( PSOC_GW_PROFILE, _##field )
+#define PSOC_GW_CFG_PASTE( profile, field )     PSOC_GW_CFG_PASTE_( profile, field )
+#define PSOC_GW_CFG_PASTE_( profile, field )    profile##field
+
+/* Bytes of buffer pool RAM a profile allocates */
+#define PSOC_GW_PROFILE_POOL_RAM( p )           ( PSOC_GW_BT_POOL_0_SIZE * p##_BT_POOL_0_COUNT + \
+                                                  PSOC_GW_BT_POOL_1_SIZE * p##_BT_POOL_1_COUNT + \
+                                                  PSOC_GW_BT_POOL_2_SIZE * p##_BT_POOL_2_COUNT + \
+                                                  PSOC_GW_BT_POOL_3_SIZE * p##_BT_POOL_3_COUNT )
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* Every profile, in table order */
+#define PSOC_GW_PROFILES( PROFILE )             \
+    PROFILE( PSOC_GW_DEFAULT )                  \
+    PROFILE( PSOC_GW_DENSE_CORRIDOR )           \
+    PROFILE( PSOC_GW_LOW_POWER_BATTERY )        \
+    PROFILE( PSOC_GW_BACKHAUL_CONSTRAINED )
+
+/* Pool buffer sizes are common to all profiles, only the counts are tuned */
+#define PSOC_GW_BT_POOL_0_SIZE                  (64)
+#define PSOC_GW_BT_POOL_1_SIZE                  (158)
+#define PSOC_GW_BT_POOL_2_SIZE                  (360)
+#define PSOC_GW_BT_POOL_3_SIZE                  (660)
+
+/**
+ * The stack allocates its buffer pools from the heap, which the AWS/TLS connection
+ * needs as well. psoc_gw.mk passes PSOC_GW_PLATFORM_HEAP_SIZE for platforms where
+ * the app pins the heap; everywhere else the 40 KB heap it pins for CYW9MCU7X9N364
+ * is assumed, so a profile that fits there fits every platform.
+ */
+#ifndef PSOC_GW_PLATFORM_HEAP_SIZE
+#define PSOC_GW_PLATFORM_HEAP_SIZE              40*1024
+#endif
+#define PSOC_GW_BT_POOL_HEAP_PERCENT            (35)
+#define PSOC_GW_BT_POOL_RAM_BUDGET              ( ( PSOC_GW_PLATFORM_HEAP_SIZE ) * PSOC_GW_BT_POOL_HEAP_PERCENT / 100 )
+
+/**
+ * Default profile: the configuration the gateway has always shipped with.
+ */
+#define PSOC_GW_DEFAULT_ID                                      0
+#define PSOC_GW_DEFAULT_NAME                                    "DEFAULT"
+#define PSOC_GW_DEFAULT_HIGH_DUTY_SCAN_INTERVAL                 WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_INTERVAL
+#define PSOC_GW_DEFAULT_HIGH_DUTY_SCAN_WINDOW                   WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_WINDOW
+#define PSOC_GW_DEFAULT_LOW_DUTY_SCAN_INTERVAL                  WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_INTERVAL
+#define PSOC_GW_DEFAULT_LOW_DUTY_SCAN_WINDOW                    WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_WINDOW
+#define PSOC_GW_DEFAULT_SCAN_DURATION_SECONDS                   (5)
+#define PSOC_GW_DEFAULT_LOW_DUTY_SCAN_DURATION_SECONDS          (5)
+#define PSOC_GW_DEFAULT_GATT_CLIENT_MAX_LINKS                   (3)
+#define PSOC_GW_DEFAULT_GATT_SERVER_MAX_LINKS                   (1)
+#define PSOC_GW_DEFAULT_GATT_MAX_ATTR_LEN                       (512)
+#define PSOC_GW_DEFAULT_ADDR_RESOLUTION_DB_SIZE                 (5)
+#define PSOC_GW_DEFAULT_BT_POOL_0_COUNT                         (10)
+#define PSOC_GW_DEFAULT_BT_POOL_1_COUNT                         (12)
+#define PSOC_GW_DEFAULT_BT_POOL_2_COUNT                         (12)
+#define PSOC_GW_DEFAULT_BT_POOL_3_COUNT                         (10)
+#define PSOC_GW_DEFAULT_WINDOWS_PER_PUBLISH                     (1)
+#define PSOC_GW_DEFAULT_PUBLISH_QOS                             WICED_AWS_QOS_ATMOST_ONCE
+#define PSOC_GW_DEFAULT_PUBLISH_RETRY_COUNT                     (5)
+
+/*
+ * PROVISIONAL: the pool counts, GATT capacities and scan timing of the profiles
+ * below are estimates, not derived from [BT/Pool] captures. Replace them with the
+ * output of tools/bt_pool_sizing.py once captures from a real deployment exist.
+ */
+
+/**
+ * Narrow, crowded passage: scan continuously so short advertising bursts are not
+ * missed, with many small buffers to absorb advertising storms. No GATT client.
+ */
+#define PSOC_GW_DENSE_CORRIDOR_ID                               1
+#define PSOC_GW_DENSE_CORRIDOR_NAME                             "DENSE_CORRIDOR"
+#define PSOC_GW_DENSE_CORRIDOR_HIGH_DUTY_SCAN_INTERVAL          (96)        /* 60 ms */
+#define PSOC_GW_DENSE_CORRIDOR_HIGH_DUTY_SCAN_WINDOW            (96)        /* 60 ms, 100% duty cycle */
+#define PSOC_GW_DENSE_CORRIDOR_LOW_DUTY_SCAN_INTERVAL           (96)
+#define PSOC_GW_DENSE_CORRIDOR_LOW_DUTY_SCAN_WINDOW             (48)
+#define PSOC_GW_DENSE_CORRIDOR_SCAN_DURATION_SECONDS            (5)
+#define PSOC_GW_DENSE_CORRIDOR_LOW_DUTY_SCAN_DURATION_SECONDS   (5)
+#define PSOC_GW_DENSE_CORRIDOR_GATT_CLIENT_MAX_LINKS            (0)
+#define PSOC_GW_DENSE_CORRIDOR_GATT_SERVER_MAX_LINKS            (1)
+#define PSOC_GW_DENSE_CORRIDOR_GATT_MAX_ATTR_LEN                (512)
+#define PSOC_GW_DENSE_CORRIDOR_ADDR_RESOLUTION_DB_SIZE          (5)
+#define PSOC_GW_DENSE_CORRIDOR_BT_POOL_0_COUNT                  (24)
+#define PSOC_GW_DENSE_CORRIDOR_BT_POOL_1_COUNT                  (12)
+#define PSOC_GW_DENSE_CORRIDOR_BT_POOL_2_COUNT                  (4)
+#define PSOC_GW_DENSE_CORRIDOR_BT_POOL_3_COUNT                  (2)
+#define PSOC_GW_DENSE_CORRIDOR_WINDOWS_PER_PUBLISH              (1)
+#define PSOC_GW_DENSE_CORRIDOR_PUBLISH_QOS                      WICED_AWS_QOS_ATMOST_ONCE
+#define PSOC_GW_DENSE_CORRIDOR_PUBLISH_RETRY_COUNT              (5)
+
+/**
+ * Battery powered gateway: 10% radio duty cycle, longer windows and one publish
+ * per minute. Minimal buffer pools.
+ */
+#define PSOC_GW_LOW_POWER_BATTERY_ID                            2
+#define PSOC_GW_LOW_POWER_BATTERY_NAME                          "LOW_POWER_BATTERY"
+#define PSOC_GW_LOW_POWER_BATTERY_HIGH_DUTY_SCAN_INTERVAL       (480)       /* 300 ms */
+#define PSOC_GW_LOW_POWER_BATTERY_HIGH_DUTY_SCAN_WINDOW         (48)        /* 30 ms, 10% duty cycle */
+#define PSOC_GW_LOW_POWER_BATTERY_LOW_DUTY_SCAN_INTERVAL        WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_INTERVAL
+#define PSOC_GW_LOW_POWER_BATTERY_LOW_DUTY_SCAN_WINDOW          WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_WINDOW
+#define PSOC_GW_LOW_POWER_BATTERY_SCAN_DURATION_SECONDS         (10)
+#define PSOC_GW_LOW_POWER_BATTERY_LOW_DUTY_SCAN_DURATION_SECONDS (5)
+#define PSOC_GW_LOW_POWER_BATTERY_GATT_CLIENT_MAX_LINKS         (0)
+#define PSOC_GW_LOW_POWER_BATTERY_GATT_SERVER_MAX_LINKS         (1)
+#define PSOC_GW_LOW_POWER_BATTERY_GATT_MAX_ATTR_LEN             (512)
+#define PSOC_GW_LOW_POWER_BATTERY_ADDR_RESOLUTION_DB_SIZE       (3)
+#define PSOC_GW_LOW_POWER_BATTERY_BT_POOL_0_COUNT               (8)
+#define PSOC_GW_LOW_POWER_BATTERY_BT_POOL_1_COUNT               (6)
+#define PSOC_GW_LOW_POWER_BATTERY_BT_POOL_2_COUNT               (2)
+#define PSOC_GW_LOW_POWER_BATTERY_BT_POOL_3_COUNT               (1)
+#define PSOC_GW_LOW_POWER_BATTERY_WINDOWS_PER_PUBLISH           (6)
+#define PSOC_GW_LOW_POWER_BATTERY_PUBLISH_QOS                   WICED_AWS_QOS_ATMOST_ONCE
+#define PSOC_GW_LOW_POWER_BATTERY_PUBLISH_RETRY_COUNT           (3)
+
+/**
+ * Slow or metered uplink: default scan timing, counts aggregated over a minute
+ * and published with acknowledgment since each message carries more data.
+ */
+#define PSOC_GW_BACKHAUL_CONSTRAINED_ID                         3
+#define PSOC_GW_BACKHAUL_CONSTRAINED_NAME                       "BACKHAUL_CONSTRAINED"
+#define PSOC_GW_BACKHAUL_CONSTRAINED_HIGH_DUTY_SCAN_INTERVAL    WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_INTERVAL
+#define PSOC_GW_BACKHAUL_CONSTRAINED_HIGH_DUTY_SCAN_WINDOW      WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_WINDOW
+#define PSOC_GW_BACKHAUL_CONSTRAINED_LOW_DUTY_SCAN_INTERVAL     WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_INTERVAL
+#define PSOC_GW_BACKHAUL_CONSTRAINED_LOW_DUTY_SCAN_WINDOW       WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_WINDOW
+#define PSOC_GW_BACKHAUL_CONSTRAINED_SCAN_DURATION_SECONDS      (5)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_LOW_DUTY_SCAN_DURATION_SECONDS (5)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_GATT_CLIENT_MAX_LINKS      (0)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_GATT_SERVER_MAX_LINKS      (1)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_GATT_MAX_ATTR_LEN          (512)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_ADDR_RESOLUTION_DB_SIZE    (5)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_BT_POOL_0_COUNT            (16)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_BT_POOL_1_COUNT            (10)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_BT_POOL_2_COUNT            (4)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_BT_POOL_3_COUNT            (2)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_WINDOWS_PER_PUBLISH        (12)
+#define PSOC_GW_BACKHAUL_CONSTRAINED_PUBLISH_QOS                WICED_AWS_QOS_ATLEAST_ONCE
+#define PSOC_GW_BACKHAUL_CONSTRAINED_PUBLISH_RETRY_COUNT        (3)
+
+/* Active profile, as used by wiced_bt_cfg.c and psoc_gw.c */
+#define PSOC_GW_PROFILE_NAME                    PSOC_GW_CFG( NAME )
+#define PSOC_GW_HIGH_DUTY_SCAN_INTERVAL         PSOC_GW_CFG( HIGH_DUTY_SCAN_INTERVAL )
+#define PSOC_GW_HIGH_DUTY_SCAN_WINDOW           PSOC_GW_CFG( HIGH_DUTY_SCAN_WINDOW )
+#define PSOC_GW_LOW_DUTY_SCAN_INTERVAL          PSOC_GW_CFG( LOW_DUTY_SCAN_INTERVAL )
+#define PSOC_GW_LOW_DUTY_SCAN_WINDOW            PSOC_GW_CFG( LOW_DUTY_SCAN_WINDOW )
+#define PSOC_GW_SCAN_DURATION_SECONDS           PSOC_GW_CFG( SCAN_DURATION_SECONDS )
+#define PSOC_GW_LOW_DUTY_SCAN_DURATION_SECONDS  PSOC_GW_CFG( LOW_DUTY_SCAN_DURATION_SECONDS )
+#define PSOC_GW_GATT_CLIENT_MAX_LINKS           PSOC_GW_CFG( GATT_CLIENT_MAX_LINKS )
+#define PSOC_GW_GATT_SERVER_MAX_LINKS           PSOC_GW_CFG( GATT_SERVER_MAX_LINKS )
+#define PSOC_GW_GATT_MAX_ATTR_LEN               PSOC_GW_CFG( GATT_MAX_ATTR_LEN )
+#define PSOC_GW_ADDR_RESOLUTION_DB_SIZE         PSOC_GW_CFG( ADDR_RESOLUTION_DB_SIZE )
+#define PSOC_GW_BT_POOL_0_COUNT                 PSOC_GW_CFG( BT_POOL_0_COUNT )
+#define PSOC_GW_BT_POOL_1_COUNT                 PSOC_GW_CFG( BT_POOL_1_COUNT )
+#define PSOC_GW_BT_POOL_2_COUNT                 PSOC_GW_CFG( BT_POOL_2_COUNT )
+#define PSOC_GW_BT_POOL_3_COUNT                 PSOC_GW_CFG( BT_POOL_3_COUNT )
+#define PSOC_GW_WINDOWS_PER_PUBLISH             PSOC_GW_CFG( WINDOWS_PER_PUBLISH )
+#define PSOC_GW_PUBLISH_QOS                     PSOC_GW_CFG( PUBLISH_QOS )
+#define PSOC_GW_PUBLISH_RETRY_COUNT             PSOC_GW_CFG( PUBLISH_RETRY_COUNT )
+
+#if ( WICED_BT_CFG_NUM_BUF_POOLS != 4 )
+#error "PSOC_GW profile: profiles describe exactly 4 buffer pools"
+#endif
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+typedef struct
+{
+    const char* name;
+    uint16_t    high_duty_scan_interval;
+    uint16_t    high_duty_scan_window;
+    uint16_t    low_duty_scan_interval;
+    uint16_t    low_duty_scan_window;
+    uint16_t    scan_duration_seconds;
+    uint16_t    low_duty_scan_duration_seconds;
+    uint8_t     gatt_client_max_links;
+    uint8_t     gatt_server_max_links;
+    uint16_t    gatt_max_attr_len;
+    uint8_t     addr_resolution_db_size;
+    uint16_t    bt_pool_count[WICED_BT_CFG_NUM_BUF_POOLS];
+    uint32_t    bt_pool_ram;                /* Bytes of buffer pool RAM, at most PSOC_GW_BT_POOL_RAM_BUDGET */
+    uint8_t     windows_per_publish;
+    uint8_t     publish_qos;                /* wiced_aws_qos_level_t */
+    uint8_t     publish_retry_count;
+} psoc_gw_profile_t;
+
+/******************************************************
+ *               Function Declarations
+ ******************************************************/
+
+/* Table entry of the profile this image was built with */
+const psoc_gw_profile_t* psoc_gw_profile_get( void );
+
+/* Print the active profile to the console */
+void psoc_gw_profile_print( void );
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
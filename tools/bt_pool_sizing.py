@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Recommend deployment profile buffer pool counts from recorded pool telemetry.
+
+Feed it one or more console captures containing the "[BT/Pool] ..." lines
+printed by bt_pool_stats.c, one capture per boot. For each pool the largest
+high-water mark over all captures and the total exhaustion count is used:
+
+  * a pool that never filled up gets its high-water mark plus a safety margin,
+  * a pool that filled up at least once is grown, since the real demand spilled
+    over into the next pool and is not visible in its own counters,
+  * no pool drops below --min-count buffers.
+
+The GATT configuration is derived from --gatt-links and the pool table:
+max_attr_len must fit into one of the pools. The output is a block of
+PSOC_GW_<profile>_* defines to paste into psoc_gw_profile.h.
+
+Usage:
+  bt_pool_sizing.py [--profile NAME] [--margin 0.25] [--min-count 2] [--gatt-links C S] capture.log [...]
+"""
+
+import argparse
+import math
+import re
+import sys
+
+POOL_LINE = re.compile(
+    r"\[BT/Pool\] sample=(?P<sample>\d+) pool=(?P<pool>\d+) size=(?P<size>\d+) count=(?P<count>\d+)"
+    r" in_use=(?P<in_use>\d+) high_water=(?P<high_water>\d+) exhausted=(?P<exhausted>\d+)")
+
+# Largest attribute length the stack accepts (see psoc_gw_profile.h)
+MAX_ATTR_LEN = 512
+
+
+def parse(paths):
+    pools = {}
+    samples = 0
+    for path in paths:
+        # The sample and exhaustion counters are cumulative since boot, so each capture contributes its last values
+        capture_samples = 0
+        capture_exhausted = {}
+        with open(path, errors="replace") as capture:
+            for line in capture:
+                match = POOL_LINE.search(line)
+                if not match:
+                    continue
+                fields = {key: int(value) for key, value in match.groupdict().items()}
+                pool = pools.setdefault(fields["pool"], {"size": fields["size"], "count": fields["count"],
+                                                         "high_water": 0, "exhausted": 0})
+                if pool["size"] != fields["size"] or pool["count"] != fields["count"]:
+                    sys.exit("pool %d changed from %dx%d to %dx%d between captures; record one configuration at a time"
+                             % (fields["pool"], pool["size"], pool["count"], fields["size"], fields["count"]))
+                pool["high_water"] = max(pool["high_water"], fields["high_water"])
+                capture_exhausted[fields["pool"]] = max(capture_exhausted.get(fields["pool"], 0), fields["exhausted"])
+                capture_samples = max(capture_samples, fields["sample"])
+        samples += capture_samples
+        for pool_id, exhausted in capture_exhausted.items():
+            pools[pool_id]["exhausted"] += exhausted
+    return [pools[pool_id] for pool_id in sorted(pools)], samples
+
+
+def recommend(pools, margin, min_count):
+    for pool in pools:
+        if pool["exhausted"]:
+            wanted = pool["count"] + math.ceil(pool["count"] * max(margin, 0.5))
+        else:
+            wanted = math.ceil(pool["high_water"] * (1.0 + margin))
+        pool["recommended"] = max(wanted, min_count)
+
+
+def ram(pools, key):
+    return sum(pool["size"] * pool[key] for pool in pools)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("captures", nargs="+", help="console captures containing [BT/Pool] lines")
+    parser.add_argument("--profile", default="DEFAULT", help="profile the captures were recorded with")
+    parser.add_argument("--margin", type=float, default=0.25, help="headroom added on top of the high-water mark")
+    parser.add_argument("--min-count", type=int, default=2, help="smallest buffer count of any pool")
+    parser.add_argument("--gatt-links", type=int, nargs=2, metavar=("CLIENT", "SERVER"), default=(0, 0),
+                        help="GATT client/server links the application actually opens")
+    args = parser.parse_args()
+
+    pools, samples = parse(args.captures)
+    if not pools:
+        sys.exit("no [BT/Pool] lines found")
+    recommend(pools, args.margin, args.min_count)
+
+    print("/* Recommended from %d scan windows in %d captures: %d -> %d bytes of pool RAM */"
+          % (samples, len(args.captures), ram(pools, "count"), ram(pools, "recommended")))
+    prefix = "PSOC_GW_%s_" % args.profile.upper()
+    for pool_id, pool in enumerate(pools):
+        note = "%d bytes, high water %d/%d" % (pool["size"], pool["high_water"], pool["count"])
+        if pool["exhausted"]:
+            note += ", exhausted in %d windows" % pool["exhausted"]
+        print("#define %-55s (%d)%s/* %s */" % (prefix + "BT_POOL_%d_COUNT" % pool_id, pool["recommended"],
+                                                 " " * (8 - len(str(pool["recommended"]))), note))
+
+    # The stack needs a pool that can hold max_attr_len. Without GATT links no attribute is ever
+    # transferred, so the limit can drop to the smallest pool and stop pinning the largest one.
+    client_links, server_links = args.gatt_links
+    if client_links or server_links:
+        max_attr_len = min(MAX_ATTR_LEN, pools[-1]["size"])
+    else:
+        max_attr_len = min(MAX_ATTR_LEN, pools[0]["size"])
+
+    print("")
+    print("#define %-55s (%d)" % (prefix + "GATT_CLIENT_MAX_LINKS", client_links))
+    print("#define %-55s (%d)" % (prefix + "GATT_SERVER_MAX_LINKS", server_links))
+    print("#define %-55s (%d)" % (prefix + "GATT_MAX_ATTR_LEN", max_attr_len))
+
+
+if __name__ == "__main__":
+    main()
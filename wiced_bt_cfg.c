@@ -31,6 +31,7 @@
 #include "wiced_bt_ble.h"
 #include "wiced_bt_gatt.h"
 #include "wiced_bt_cfg.h"
+#include "psoc_gw_profile.h"
 
 
 
@@ -40,7 +41,6 @@
 const wiced_bt_cfg_settings_t wiced_bt_cfg_settings =
 {
         .max_number_of_buffer_pools = WICED_BT_CFG_NUM_BUF_POOLS,
-        .addr_resolution_db_size = 3,
     .br_edr_scan_cfg =                                                                               // BR/EDR scan settings
     {
         .inquiry_scan_type               = BTM_SCAN_TYPE_STANDARD,                                   // Inquiry scan type (BTM_SCAN_TYPE_STANDARD or BTM_SCAN_TYPE_INTERLACED)
@@ -56,13 +56,13 @@ const wiced_bt_cfg_settings_t wiced_bt_cfg_settings =
     {
         .scan_mode                       = BTM_BLE_SCAN_MODE_PASSIVE,                                 // BLE scan mode (BTM_BLE_SCAN_MODE_PASSIVE, BTM_BLE_SCAN_MODE_ACTIVE, or BTM_BLE_SCAN_MODE_NONE)
 
-        .high_duty_scan_interval         = WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_INTERVAL,             // High duty scan interval
-        .high_duty_scan_window           = WICED_BT_CFG_DEFAULT_HIGH_DUTY_SCAN_WINDOW,               // High duty scan window
-        .high_duty_scan_duration         = 5,                                                        // High duty scan duration in seconds (0 for infinite)
+        .high_duty_scan_interval         = PSOC_GW_HIGH_DUTY_SCAN_INTERVAL,                          // High duty scan interval
+        .high_duty_scan_window           = PSOC_GW_HIGH_DUTY_SCAN_WINDOW,                            // High duty scan window
+        .high_duty_scan_duration         = PSOC_GW_SCAN_DURATION_SECONDS,                            // High duty scan duration in seconds (0 for infinite)
 
-        .low_duty_scan_interval          = WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_INTERVAL,              // Low duty scan interval
-        .low_duty_scan_window            = WICED_BT_CFG_DEFAULT_LOW_DUTY_SCAN_WINDOW,                // Low duty scan window
-        .low_duty_scan_duration          = 5,                                                        // Low duty scan duration in seconds (0 for infinite)
+        .low_duty_scan_interval          = PSOC_GW_LOW_DUTY_SCAN_INTERVAL,                           // Low duty scan interval
+        .low_duty_scan_window            = PSOC_GW_LOW_DUTY_SCAN_WINDOW,                             // Low duty scan window
+        .low_duty_scan_duration          = PSOC_GW_LOW_DUTY_SCAN_DURATION_SECONDS,                   // Low duty scan duration in seconds (0 for infinite)
 
         /* Connection scan intervals */
         .high_duty_conn_scan_interval    = WICED_BT_CFG_DEFAULT_HIGH_DUTY_CONN_SCAN_INTERVAL,        // High duty cycle connection scan interval
@@ -85,9 +85,9 @@ const wiced_bt_cfg_settings_t wiced_bt_cfg_settings =
     .gatt_cfg =                                                                                      // GATT configuration
     {
         .appearance                     = APPEARANCE_GENERIC_TAG,                                    // GATT appearance (see gatt_appearance_e)
-        .client_max_links               = 3,                                                         // Client config: maximum number of servers that local client can connect to
-        .server_max_links               = 1,                                                         // Server config: maximum number of remote clients connections allowed by the local
-        .max_attr_len                   = 512                                                        // Maximum attribute length; gki_cfg must have a corresponding buffer pool that can hold this length
+        .client_max_links               = PSOC_GW_GATT_CLIENT_MAX_LINKS,                             // Client config: maximum number of servers that local client can connect to
+        .server_max_links               = PSOC_GW_GATT_SERVER_MAX_LINKS,                             // Server config: maximum number of remote clients connections allowed by the local
+        .max_attr_len                   = PSOC_GW_GATT_MAX_ATTR_LEN                                  // Maximum attribute length; gki_cfg must have a corresponding buffer pool that can hold this length
     },
 
     .rfcomm_cfg =                                                                                    // RFCOMM configuration
@@ -119,7 +119,7 @@ const wiced_bt_cfg_settings_t wiced_bt_cfg_settings =
         .roles                          = 0,                                                         // Mask of local roles supported (AVRC_CONN_INITIATOR|AVRC_CONN_ACCEPTOR)
         .max_links                      = 0                                                          // Maximum simultaneous remote control links
     },
-    .addr_resolution_db_size            = 5//,                                                         // LE Address Resolution DB settings - effective only for pre 4.2 controller
+    .addr_resolution_db_size            = PSOC_GW_ADDR_RESOLUTION_DB_SIZE//,                           // LE Address Resolution DB settings - effective only for pre 4.2 controller
     //.max_mtu_size                       = 517,                                                        // Maximum MTU size for GATT connections, should be between 23 and (max_attr_len + 5 )
     //.max_pwr_db_val                     = 12
 };
@@ -131,6 +131,8 @@ const wiced_bt_cfg_settings_t wiced_bt_cfg_settings =
  *
  * Pools must be ordered in increasing buf_size.
  * If a pool runs out of buffers, the next  pool will be used
+ *
+ * Buffer counts come from the deployment profile (psoc_gw_profile.h)
  *****************************************************************************/
 
 
@@ -141,13 +143,13 @@ const wiced_bt_cfg_buf_pool_t wiced_bt_cfg_buf_pools[WICED_BT_CFG_NUM_BUF_POOLS]
 
 /*  { buf_size, buf_count } */
 
-    { 64,       10   },      /* can be used when attribute length is less than or equal to 64 and buffers are available */
+    { PSOC_GW_BT_POOL_0_SIZE, PSOC_GW_BT_POOL_0_COUNT },      /* can be used when attribute length is less than or equal to 64 and buffers are available */
 
-    { 158,      12  },      /* can be used by when attribute length is less than or equal to 158 bytes */
+    { PSOC_GW_BT_POOL_1_SIZE, PSOC_GW_BT_POOL_1_COUNT },      /* can be used by when attribute length is less than or equal to 158 bytes */
 
-    { 360,      12  },      /* will only be used when previous buffer-pools are not available */
+    { PSOC_GW_BT_POOL_2_SIZE, PSOC_GW_BT_POOL_2_COUNT },      /* will only be used when previous buffer-pools are not available */
 
-    { 660,      10  },      /* will only be used when previous buffer-pools are not available */
+    { PSOC_GW_BT_POOL_3_SIZE, PSOC_GW_BT_POOL_3_COUNT },      /* will only be used when previous buffer-pools are not available */
 
 };
 